@@ -0,0 +1,159 @@
+//Bunnymark variant that compares the CPU cost of submitting sprites one by one with rf_draw_texture() against rf_draw_sprites()
+//and rf_draw_sprites_instanced(). The modes cycle every MODE_INTERVAL frames and the average sprites per millisecond of CPU
+//time is printed for each, along with the bytes uploaded per sprite
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#define rf_max_batch_elements (8192*2)
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define MAX_BUNNIES 100000 // 100K bunnies, around 6 batch flushes per frame
+#define SPAWN_PER_FRAME 500
+#define MODE_INTERVAL 240 // Frames before switching the submission mode
+
+typedef struct bunny bunny;
+struct bunny
+{
+    rf_vector2 position;
+    rf_vector2 speed;
+    rf_color color;
+};
+
+rf_texture2d        bunny_texture;
+bunny*              bunnies;
+rf_sprite_instance* sprites;
+int                 bunnies_count;
+
+typedef enum submit_mode submit_mode;
+enum submit_mode
+{
+    submit_draw_texture,
+    submit_draw_sprites,
+    submit_draw_sprites_instanced,
+    submit_mode_count,
+};
+
+const char* submit_mode_names[submit_mode_count] = { "rf_draw_texture", "rf_draw_sprites", "rf_draw_sprites_instanced" };
+const int submit_mode_bytes[submit_mode_count] = { 4 * sizeof(rf_batch_vertex), 4 * sizeof(rf_batch_vertex), sizeof(rf_instanced_sprite) };
+
+int         frames_count;
+submit_mode mode;
+double interval_cpu_ms;
+double interval_sprites;
+
+int random_value_in_range(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    return (rand() % (abs(max - min) + 1) + min);
+}
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    bunny_texture = rf_load_texture("../../../examples/assets/wabbit_alpha.png");
+
+    bunnies = (bunny*) malloc(MAX_BUNNIES * sizeof(bunny)); // Bunnies array
+    sprites = (rf_sprite_instance*) malloc(MAX_BUNNIES * sizeof(rf_sprite_instance)); // Sprites submitted with rf_draw_sprites and rf_draw_sprites_instanced
+
+    srand(42); // Same bunnies on every run
+}
+
+void on_frame(const input_data input)
+{
+    // Spawn bunnies until the limit is reached
+    for (int i = 0; i < SPAWN_PER_FRAME && bunnies_count < MAX_BUNNIES; i++)
+    {
+        bunnies[bunnies_count].position = (rf_vector2) { screen_width / 2.0f, screen_height / 2.0f };
+        bunnies[bunnies_count].speed.x = (float) random_value_in_range(-250, 250) / 60.0f;
+        bunnies[bunnies_count].speed.y = (float) random_value_in_range(-250, 250) / 60.0f;
+        bunnies[bunnies_count].color = (rf_color) { random_value_in_range(50, 240),random_value_in_range(80, 240), random_value_in_range(100, 240), 255 };
+        bunnies_count++;
+    }
+
+    // Update bunnies
+    for (int i = 0; i < bunnies_count; i++)
+    {
+        bunnies[i].position.x += bunnies[i].speed.x;
+        bunnies[i].position.y += bunnies[i].speed.y;
+
+        if (((bunnies[i].position.x + bunny_texture.width / 2) > screen_width) ||
+            ((bunnies[i].position.x + bunny_texture.width / 2) < 0)) bunnies[i].speed.x *= -1;
+        if (((bunnies[i].position.y + bunny_texture.height / 2) > screen_height) ||
+            ((bunnies[i].position.y + bunny_texture.height / 2 - 40) < 0)) bunnies[i].speed.y *= -1;
+    }
+
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Only the submission is timed, filling the sprites array is part of it so both modes start from the bunnies
+    clock_t start = clock();
+
+    if (mode != submit_draw_texture)
+    {
+        for (int i = 0; i < bunnies_count; i++)
+        {
+            sprites[i].source_rec = (rf_rectangle) { 0.0f, 0.0f, (float) bunny_texture.width, (float) bunny_texture.height };
+            sprites[i].dest_rec = (rf_rectangle) { bunnies[i].position.x, bunnies[i].position.y, (float) bunny_texture.width, (float) bunny_texture.height };
+            sprites[i].origin = (rf_vector2) { 0.0f, 0.0f };
+            sprites[i].rotation = 0.0f;
+            sprites[i].tint = bunnies[i].color;
+        }
+
+        if (mode == submit_draw_sprites) rf_draw_sprites(bunny_texture, sprites, bunnies_count);
+        else rf_draw_sprites_instanced(bunny_texture, sprites, bunnies_count);
+    }
+    else
+    {
+        for (int i = 0; i < bunnies_count; i++)
+        {
+            rf_draw_texture(bunny_texture, bunnies[i].position.x, bunnies[i].position.y, bunnies[i].color);
+        }
+    }
+
+    double cpu_ms = (double) (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+    interval_cpu_ms += cpu_ms;
+    interval_sprites += bunnies_count;
+
+    rf_draw_rectangle(0, 0, screen_width, 40, rf_black);
+
+    char text[1024];
+    snprintf(text, sizeof(text), "bunnies: %i", bunnies_count);
+    rf_draw_text(text, 120, 10, 20, rf_green);
+    snprintf(text, sizeof(text), "%s  submit: %.2f ms", submit_mode_names[mode], cpu_ms);
+    rf_draw_text(text, 300, 10, 20, rf_maroon);
+
+    rf_draw_fps(10, 10);
+
+    rf_end_drawing();
+
+    frames_count++;
+    if (frames_count % MODE_INTERVAL == 0)
+    {
+        printf("%s: bunnies: %i, avg submit: %.3f ms/frame, %.1f sprites/ms, %i bytes/sprite uploaded\n",
+               submit_mode_names[mode], bunnies_count,
+               interval_cpu_ms / MODE_INTERVAL, interval_cpu_ms > 0.0 ? interval_sprites / interval_cpu_ms : 0.0,
+               submit_mode_bytes[mode]);
+
+        interval_cpu_ms = 0.0;
+        interval_sprites = 0.0;
+        mode = (mode + 1) % submit_mode_count;
+    }
+}
@@ -0,0 +1,128 @@
+//Bunnymark variant that measures how often filling the batch ring has to wait on the GPU
+//Bunnies are spawned automatically up to a fixed count so runs are comparable, it also works under Mesa llvmpipe (LIBGL_ALWAYS_SOFTWARE=1)
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#define rf_max_batch_elements (8192*2)
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define MAX_BUNNIES 100000 // 100K bunnies, around 6 batch flushes per frame
+#define SPAWN_PER_FRAME 500
+#define REPORT_INTERVAL 120 // Frames between reports on stdout
+
+typedef struct bunny bunny;
+struct bunny
+{
+    rf_vector2 position;
+    rf_vector2 speed;
+    rf_color color;
+};
+
+rf_texture2d bunny_texture;
+bunny*       bunnies;
+int          bunnies_count;
+
+int frames_count;
+int last_stall_count;
+int last_orphan_count;
+int interval_stalls;
+int interval_orphans;
+
+int random_value_in_range(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    return (rand() % (abs(max - min) + 1) + min);
+}
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    bunny_texture = rf_load_texture("../../../examples/assets/wabbit_alpha.png");
+
+    bunnies = (bunny*) malloc(MAX_BUNNIES * sizeof(bunny)); // Bunnies array
+
+    srand(42); // Same bunnies on every run
+}
+
+void on_frame(const input_data input)
+{
+    // Spawn bunnies until the limit is reached
+    for (int i = 0; i < SPAWN_PER_FRAME && bunnies_count < MAX_BUNNIES; i++)
+    {
+        bunnies[bunnies_count].position = (rf_vector2) { screen_width / 2.0f, screen_height / 2.0f };
+        bunnies[bunnies_count].speed.x = (float) random_value_in_range(-250, 250) / 60.0f;
+        bunnies[bunnies_count].speed.y = (float) random_value_in_range(-250, 250) / 60.0f;
+        bunnies[bunnies_count].color = (rf_color) { random_value_in_range(50, 240),random_value_in_range(80, 240), random_value_in_range(100, 240), 255 };
+        bunnies_count++;
+    }
+
+    // Update bunnies
+    for (int i = 0; i < bunnies_count; i++)
+    {
+        bunnies[i].position.x += bunnies[i].speed.x;
+        bunnies[i].position.y += bunnies[i].speed.y;
+
+        if (((bunnies[i].position.x + bunny_texture.width / 2) > screen_width) ||
+            ((bunnies[i].position.x + bunny_texture.width / 2) < 0)) bunnies[i].speed.x *= -1;
+        if (((bunnies[i].position.y + bunny_texture.height / 2) > screen_height) ||
+            ((bunnies[i].position.y + bunny_texture.height / 2 - 40) < 0)) bunnies[i].speed.y *= -1;
+    }
+
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    for (int i = 0; i < bunnies_count; i++)
+    {
+        rf_draw_texture(bunny_texture, bunnies[i].position.x, bunnies[i].position.y, bunnies[i].color);
+    }
+
+    // Stalls and orphans of the previous frame, the counters accumulate since rf_context_init
+    int stalls = rf_gl_get_batch_stall_count() - last_stall_count;
+    int orphans = rf_gl_get_batch_orphan_count() - last_orphan_count;
+    last_stall_count += stalls;
+    last_orphan_count += orphans;
+    interval_stalls += stalls;
+    interval_orphans += orphans;
+
+    rf_draw_rectangle(0, 0, screen_width, 40, rf_black);
+
+    char text[1024];
+    snprintf(text, sizeof(text), "bunnies: %i", bunnies_count);
+    rf_draw_text(text, 120, 10, 20, rf_green);
+    snprintf(text, sizeof(text), "ring: %i  stalls/frame: %i  orphans/frame: %i", rf_max_batch_buffering, stalls, orphans);
+    rf_draw_text(text, 300, 10, 20, rf_maroon);
+
+    rf_draw_fps(10, 10);
+
+    rf_end_drawing();
+
+    frames_count++;
+    if (frames_count % REPORT_INTERVAL == 0)
+    {
+        printf("bunnies: %i, ring buffers: %i, avg stalls/frame: %.2f, avg orphans/frame: %.2f, frame time: %.2f ms\n",
+               bunnies_count, rf_max_batch_buffering,
+               (float) interval_stalls / REPORT_INTERVAL, (float) interval_orphans / REPORT_INTERVAL,
+               rf_get_frame_time() * 1000.0f);
+
+        interval_stalls = 0;
+        interval_orphans = 0;
+    }
+}
@@ -0,0 +1,225 @@
+//Color matrix benchmark: color adjustments on 4K images in R8G8B8 and R8G8B8A8, the old way and with the new functions
+//The "float per pixel" lines are the old code: rf_get_image_data, float math on every channel, rf_load_image_ex and
+//rf_image_format. Tint, contrast and brightness run as 3 calls and folded in one rf_image_color_matrix pass
+//Before the timings the identity matrix is checked to leave gray and float images unchanged, the benchmark fails if it doesn't
+//Usage: color_matrix_benchmark [width height]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define BENCHMARK_MIN_TIME 0.5
+#define FORMATS_COUNT 2
+
+int image_width = 3840;
+int image_height = 2160;
+
+rf_color tint_color = { 200, 150, 100, 255 };
+rf_color_matrix adjustments; // Tint, contrast 30 and brightness 40 folded in one matrix
+rf_color_matrix sepia;
+
+//Replace the pixels of an image with its RGBA pixels, in its own format
+void load_pixels(rf_image* image, rf_color* pixels)
+{
+    rf_image processed = rf_load_image_ex(pixels, image->width, image->height);
+    rf_image_format(&processed, image->format);
+    rf_unload_image(*image);
+    RF_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+void float_tint(rf_image* image)
+{
+    rf_color* pixels = rf_get_image_data(*image);
+    float cR = (float)tint_color.r/255;
+    float cG = (float)tint_color.g/255;
+    float cB = (float)tint_color.b/255;
+    float cA = (float)tint_color.a/255;
+
+    for (int i = 0; i < image->width * image->height; i++)
+    {
+        pixels[i].r = 255*((float)pixels[i].r/255*cR);
+        pixels[i].g = 255*((float)pixels[i].g/255*cG);
+        pixels[i].b = 255*((float)pixels[i].b/255*cB);
+        pixels[i].a = 255*((float)pixels[i].a/255*cA);
+    }
+
+    load_pixels(image, pixels);
+}
+
+void float_sepia(rf_image* image)
+{
+    rf_color* pixels = rf_get_image_data(*image);
+
+    for (int i = 0; i < image->width * image->height; i++)
+    {
+        float r = (float)pixels[i].r/255;
+        float g = (float)pixels[i].g/255;
+        float b = (float)pixels[i].b/255;
+        float color[3] = { r*0.393f + g*0.769f + b*0.189f, r*0.349f + g*0.686f + b*0.168f, r*0.272f + g*0.534f + b*0.131f };
+
+        for (int c = 0; c < 3; c++) if (color[c] > 1.0f) color[c] = 1.0f;
+
+        pixels[i].r = (unsigned char)(color[0]*255 + 0.5f);
+        pixels[i].g = (unsigned char)(color[1]*255 + 0.5f);
+        pixels[i].b = (unsigned char)(color[2]*255 + 0.5f);
+    }
+
+    load_pixels(image, pixels);
+}
+
+void tint(rf_image* image) { rf_image_color_tint(image, tint_color); }
+void matrix_tint(rf_image* image) { rf_image_color_matrix(image, rf_color_matrix_tint(tint_color)); }
+
+void adjustments_calls(rf_image* image)
+{
+    rf_image_color_tint(image, tint_color);
+    rf_image_color_contrast(image, 30);
+    rf_image_color_brightness(image, 40);
+}
+
+void adjustments_folded(rf_image* image) { rf_image_color_matrix(image, adjustments); }
+void matrix_sepia(rf_image* image) { rf_image_color_matrix(image, sepia); }
+
+typedef struct image_op
+{
+    const char* name;
+    void (*proc)(rf_image* image);
+} image_op;
+
+image_op ops[] = {
+    { "tint (float per pixel)", float_tint },
+    { "tint", tint },
+    { "tint (color matrix)", matrix_tint },
+    { "3 adjustments (3 calls)", adjustments_calls },
+    { "3 adjustments (folded)", adjustments_folded },
+    { "sepia (float per pixel)", float_sepia },
+    { "sepia (color matrix)", matrix_sepia },
+};
+#define OPS_COUNT 7
+
+//Source image with a gradient and some noise
+rf_image make_image(int format)
+{
+    rf_color* pixels = (rf_color*) malloc(image_width * image_height * sizeof(rf_color));
+    unsigned int random_state = 12345;
+
+    for (int y = 0; y < image_height; y++)
+    {
+        for (int x = 0; x < image_width; x++)
+        {
+            random_state = random_state * 1103515245 + 12345;
+            pixels[y * image_width + x] = (rf_color){ x * 255 / image_width, y * 255 / image_height, (random_state >> 16) & 0xff, 255 };
+        }
+    }
+
+    rf_image image = rf_load_image_ex(pixels, image_width, image_height);
+    rf_image_format(&image, format);
+    free(pixels);
+
+    return image;
+}
+
+//The identity matrix must give back the exact bytes of gray images and the exact values of float images, out of [0, 1] ones included
+bool check_identity(void)
+{
+    int formats[5] = { rf_uncompressed_grayscale, rf_uncompressed_gray_alpha, rf_uncompressed_r32, rf_uncompressed_r32g32b32, rf_uncompressed_r32g32b32a32 };
+    const char* format_names[5] = { "gray", "gray_alpha", "r32", "r32g32b32", "r32g32b32a32" };
+    bool ok = true;
+
+    for (int f = 0; f < 5; f++)
+    {
+        rf_image image = { 0 };
+        image.width = 67;
+        image.height = 13;
+        image.mipmaps = 1;
+        image.format = formats[f];
+
+        // Every byte value for the 8 bit formats, floats in and out of [0, 1] for the others
+        int size = rf_get_pixel_data_size(image.width, image.height, image.format);
+        unsigned char* bytes = (unsigned char*) malloc(size);
+        if (f < 2) for (int i = 0; i < size; i++) bytes[i] = (unsigned char)(i * 7 / 2);
+        else for (int i = 0; i < size / (int)sizeof(float); i++) ((float*)bytes)[i] = (float)((i * 37) % 101) / 40.0f - 0.5f;
+
+        image.data = malloc(size);
+        memcpy(image.data, bytes, size);
+
+        rf_image_color_matrix(&image, rf_color_matrix_identity());
+
+        int changed = 0;
+        for (int i = 0; i < size; i++) if (((unsigned char*)image.data)[i] != bytes[i]) changed++;
+
+        if (changed > 0)
+        {
+            printf("identity matrix changed %i of %i bytes of a %s image\n", changed, size, format_names[f]);
+            ok = false;
+        }
+
+        free(bytes);
+        rf_unload_image(image);
+    }
+
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        image_width = atoi(argv[1]);
+        image_height = atoi(argv[2]);
+    }
+
+    if (!check_identity()) return 1;
+
+    adjustments = rf_color_matrix_multiply(rf_color_matrix_multiply(rf_color_matrix_tint(tint_color), rf_color_matrix_contrast(30)), rf_color_matrix_brightness(40));
+
+    sepia = rf_color_matrix_identity();
+    float sepia_rows[3][3] = { { 0.393f, 0.769f, 0.189f }, { 0.349f, 0.686f, 0.168f }, { 0.272f, 0.534f, 0.131f } };
+    for (int row = 0; row < 3; row++)
+    {
+        for (int column = 0; column < 3; column++) sepia.m[5 * row + column] = sepia_rows[row][column];
+    }
+
+    int formats[FORMATS_COUNT] = { rf_uncompressed_r8g8b8, rf_uncompressed_r8g8b8a8 };
+    const char* format_names[FORMATS_COUNT] = { "rgb", "rgba" };
+    double pixels = (double)image_width * image_height;
+
+    printf("%ix%i images\n", image_width, image_height);
+    printf("%-26s %-6s %10s\n", "operation", "format", "ns/pixel");
+
+    for (int f = 0; f < FORMATS_COUNT; f++)
+    {
+        rf_image source = make_image(formats[f]);
+
+        for (int o = 0; o < OPS_COUNT; o++)
+        {
+            double time = 0;
+            int runs = 0;
+
+            while ((time < BENCHMARK_MIN_TIME) || (runs == 0))
+            {
+                rf_image image = rf_image_copy(source);
+
+                double start = rf_get_time();
+                ops[o].proc(&image);
+                time += rf_get_time() - start;
+                runs++;
+
+                rf_unload_image(image);
+            }
+
+            printf("%-26s %-6s %10.2f\n", ops[o].name, format_names[f], time * 1e9 / (runs * pixels));
+        }
+
+        rf_unload_image(source);
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+//Command buffers example: rings, bezier lines and rounded rectangles are tessellated on WORKER_COUNT threads
+//Every worker records one band of the screen into its own command buffer, the main thread submits them in band order
+//Recording switches between the worker threads and the main thread every MODE_INTERVAL frames, the recording time is printed
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#define RF_THREAD_LOCAL_CONTEXT // Every thread records with its own global context pointer
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+#include <stdint.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+rf_context rf_ctx;
+
+#define WORKER_COUNT 4
+#define SHAPES_PER_WORKER 400
+#define MODE_INTERVAL 240 // Frames before switching between threaded and single threaded recording
+
+rf_command_buffer command_buffers[WORKER_COUNT];
+
+int    frames_count;
+bool   threaded = true;
+double interval_record_time;
+
+// Record the shapes of one band of the screen into a command buffer
+void record_band(int band)
+{
+    rf_command_buffer_begin(&command_buffers[band]);
+
+    float band_height = (float)(screen_height - 40) / WORKER_COUNT;
+    float top = 40 + band * band_height;
+
+    for (int i = 0; i < SHAPES_PER_WORKER; i++)
+    {
+        float x = (float)((i * 37 + frames_count) % screen_width);
+        float y = top + (float)((i * 13) % (int)band_height);
+        rf_color color = rf_color_from_hsv((rf_vector3){ (float)((i * 7 + band * 90) % 360), 0.8f, 0.9f });
+
+        switch (i % 3)
+        {
+            case 0: rf_draw_ring((rf_vector2){ x, y }, 4.0f, 9.0f, 0, 360, 24, color); break;
+            case 1: rf_draw_line_bezier((rf_vector2){ x, y }, (rf_vector2){ x + 40.0f, y + 10.0f }, 2.0f, color); break;
+            case 2: rf_draw_rectangle_rounded((rf_rectangle){ x, y, 24.0f, 12.0f }, 0.5f, 8, color); break;
+        }
+    }
+
+    rf_command_buffer_end(&command_buffers[band]);
+}
+
+#if defined(_WIN32)
+DWORD WINAPI worker(LPVOID arg) { record_band((int)(intptr_t)arg); return 0; }
+#else
+void* worker(void* arg) { record_band((int)(intptr_t)arg); return NULL; }
+#endif
+
+// Record all bands, on the worker threads or one after another on this thread
+void record_all()
+{
+    if (!threaded)
+    {
+        for (int i = 0; i < WORKER_COUNT; i++) record_band(i);
+        return;
+    }
+
+#if defined(_WIN32)
+    HANDLE threads[WORKER_COUNT];
+    for (int i = 0; i < WORKER_COUNT; i++) threads[i] = CreateThread(NULL, 0, worker, (LPVOID)(intptr_t)i, 0, NULL);
+    WaitForMultipleObjects(WORKER_COUNT, threads, TRUE, INFINITE);
+    for (int i = 0; i < WORKER_COUNT; i++) CloseHandle(threads[i]);
+#else
+    pthread_t threads[WORKER_COUNT];
+    for (int i = 0; i < WORKER_COUNT; i++) pthread_create(&threads[i], NULL, worker, (void*)(intptr_t)i);
+    for (int i = 0; i < WORKER_COUNT; i++) pthread_join(threads[i], NULL);
+#endif
+}
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    //Command buffers copy the context state, so they are initialised once the default font is loaded
+    for (int i = 0; i < WORKER_COUNT; i++) rf_command_buffer_init(&command_buffers[i], &rf_ctx, 1024 * 1024);
+}
+
+void on_frame(const input_data input)
+{
+    double start = rf_get_time();
+    record_all();
+    interval_record_time += rf_get_time() - start;
+
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Submission order is the band order, whichever worker finished first
+    rf_command_buffer_submit_all(command_buffers, WORKER_COUNT);
+
+    rf_draw_rectangle(0, 0, screen_width, 40, rf_black);
+
+    char text[1024];
+    snprintf(text, sizeof(text), "recording: %s", threaded ? "worker threads" : "main thread");
+    rf_draw_text(text, 120, 10, 20, rf_green);
+
+    rf_draw_fps(10, 10);
+
+    rf_end_drawing();
+
+    frames_count++;
+    if (frames_count % MODE_INTERVAL == 0)
+    {
+        printf("%s: avg recording time %.3f ms/frame\n", threaded ? "worker threads" : "main thread", interval_record_time * 1000.0 / MODE_INTERVAL);
+
+        interval_record_time = 0.0;
+        threaded = !threaded;
+    }
+}
@@ -0,0 +1,96 @@
+//Draw sorting example: a grid of icons with a text label each, alternating the icon texture and the font atlas texture
+//Draw sorting is toggled every MODE_INTERVAL frames, recorded draws and issued draw calls per frame are printed for both modes
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define GRID_COLUMNS 20
+#define GRID_ROWS 10
+#define MODE_INTERVAL 240 // Frames before toggling draw sorting
+
+rf_texture2d icon_texture;
+
+int    frames_count;
+bool   sorting;
+int    last_draw_count;
+int    last_recorded_draw_count;
+double interval_draws;
+double interval_recorded_draws;
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    icon_texture = rf_load_texture("../../../examples/assets/wabbit_alpha.png");
+}
+
+void on_frame(const input_data input)
+{
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Icons go below the labels, with sorting all icons end up in one draw call and all labels in another
+    for (int y = 0; y < GRID_ROWS; y++)
+    {
+        for (int x = 0; x < GRID_COLUMNS; x++)
+        {
+            int cell_x = x * (screen_width / GRID_COLUMNS);
+            int cell_y = 40 + y * ((screen_height - 40) / GRID_ROWS);
+
+            rf_gl_set_draw_layer(0);
+            rf_draw_texture(icon_texture, cell_x + 4, cell_y, rf_white);
+
+            char label[16];
+            snprintf(label, sizeof(label), "%i", y * GRID_COLUMNS + x);
+
+            rf_gl_set_draw_layer(1);
+            rf_draw_text(label, cell_x + 4, cell_y + 24, 10, rf_darkgray);
+        }
+    }
+
+    rf_gl_set_draw_layer(2);
+
+    // Draws of the previous frame, the counters accumulate since rf_context_init
+    int draws = rf_gl_get_batch_draw_count() - last_draw_count;
+    int recorded_draws = rf_gl_get_batch_recorded_draw_count() - last_recorded_draw_count;
+    last_draw_count += draws;
+    last_recorded_draw_count += recorded_draws;
+    interval_draws += draws;
+    interval_recorded_draws += recorded_draws;
+
+    rf_draw_rectangle(0, 0, screen_width, 40, rf_black);
+
+    char text[1024];
+    snprintf(text, sizeof(text), "sorting: %s  recorded draws: %i  draw calls: %i", sorting ? "on" : "off", recorded_draws, draws);
+    rf_draw_text(text, 120, 10, 20, rf_green);
+
+    rf_draw_fps(10, 10);
+
+    rf_end_drawing();
+
+    frames_count++;
+    if (frames_count % MODE_INTERVAL == 0)
+    {
+        printf("sorting %s: avg recorded draws/frame: %.1f, avg draw calls/frame: %.1f\n",
+               sorting ? "on" : "off", interval_recorded_draws / MODE_INTERVAL, interval_draws / MODE_INTERVAL);
+
+        interval_draws = 0.0;
+        interval_recorded_draws = 0.0;
+
+        sorting = !sorting;
+        if (sorting) rf_gl_enable_draw_sorting();
+        else rf_gl_disable_draw_sorting();
+    }
+}
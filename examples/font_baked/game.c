@@ -0,0 +1,66 @@
+//Baked font example: loads a TTF font (rf_load_font_ex), exports it as a baked font (rf_export_font) and loads it back
+//with rf_load_font_baked, which maps the file and uploads the atlas without rasterizing or packing any glyph
+//The load times of both are printed and drawn, the text drawn with both fonts must look the same
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define FONT_PATH "../../../examples/assets/KAISG.ttf"
+#define BAKED_FONT_PATH "KAISG_32.rfnt"
+#define FONT_SIZE 32
+#define CHARS_COUNT 448 // Basic Latin to Latin Extended-A and B
+
+rf_font font_ttf;
+rf_font font_baked;
+double ttf_time;
+double baked_time;
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    int font_chars[CHARS_COUNT];
+    for (int i = 0; i < CHARS_COUNT; i++) font_chars[i] = 32 + i;
+
+    double start = rf_get_time();
+    font_ttf = rf_load_font_ex(FONT_PATH, FONT_SIZE, font_chars, CHARS_COUNT);
+    ttf_time = rf_get_time() - start;
+
+    //A game would bake its fonts offline and only ship the baked files
+    rf_export_font(font_ttf, BAKED_FONT_PATH);
+
+    start = rf_get_time();
+    font_baked = rf_load_font_baked(BAKED_FONT_PATH);
+    baked_time = rf_get_time() - start;
+
+    printf("rf_load_font_ex: %.3f ms, rf_load_font_baked: %.3f ms\n", ttf_time * 1000.0, baked_time * 1000.0);
+}
+
+void on_frame(const input_data input)
+{
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    rf_draw_text_ex(font_ttf, "Loaded from the TTF file", (rf_vector2){ 20, 60 }, FONT_SIZE, 1, rf_darkgray);
+    rf_draw_text_ex(font_baked, "Loaded from the baked file", (rf_vector2){ 20, 110 }, FONT_SIZE, 1, rf_darkblue);
+    rf_draw_text_ex(font_baked, "\xc3\x80\xc3\xa9\xc4\x8d\xc5\x99\xc5\xbe \xc7\xbc\xc8\x98", (rf_vector2){ 20, 160 }, FONT_SIZE, 1, rf_darkblue);
+
+    char info[128];
+    snprintf(info, sizeof(info), "rf_load_font_ex: %.3f ms  rf_load_font_baked: %.3f ms", ttf_time * 1000.0, baked_time * 1000.0);
+    rf_draw_text(info, 10, 10, 10, rf_maroon);
+
+    rf_draw_fps(10, 24);
+
+    rf_end_drawing();
+}
@@ -0,0 +1,91 @@
+//Font cache example: loads the same TTF font baked up front (rf_load_font_ex) and as a font cache (rf_load_font_cache)
+//The load times are printed, the font cache rasterizes its glyphs the first time they are drawn
+//Small pages are used so the text on screen needs page evictions, the cache stats are drawn every frame
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define FONT_PATH "../../../examples/assets/KAISG.ttf"
+#define FONT_SIZE 32
+#define FIRST_CHAR 32
+#define CHARS_COUNT 448 // Basic Latin to Latin Extended-A and B
+#define PAGE_SIZE 256
+#define MAX_PAGES 2
+
+rf_font font_baked;
+rf_font_cache font_cache;
+
+int font_chars[CHARS_COUNT];
+char line_text[CHARS_COUNT][64];
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    for (int i = 0; i < CHARS_COUNT; i++) font_chars[i] = FIRST_CHAR + i;
+
+    double start = rf_get_time();
+    font_baked = rf_load_font_ex(FONT_PATH, FONT_SIZE, font_chars, CHARS_COUNT);
+    double baked_time = rf_get_time() - start;
+
+    start = rf_get_time();
+    font_cache = rf_load_font_cache(FONT_PATH, FONT_SIZE, PAGE_SIZE, MAX_PAGES);
+    double cache_time = rf_get_time() - start;
+
+    printf("rf_load_font_ex: %.3f ms, rf_load_font_cache: %.3f ms\n", baked_time * 1000.0, cache_time * 1000.0);
+
+    //Every line shows 32 consecutive characters encoded as UTF-8
+    for (int line = 0; line < CHARS_COUNT / 32; line++)
+    {
+        char* text = line_text[line];
+        for (int i = 0; i < 32; i++)
+        {
+            int codepoint = FIRST_CHAR + line * 32 + i;
+            if (codepoint < 0x80) *text++ = (char)codepoint;
+            else
+            {
+                *text++ = (char)(0xc0 | (codepoint >> 6));
+                *text++ = (char)(0x80 | (codepoint & 0x3f));
+            }
+        }
+        *text = '\0';
+    }
+}
+
+void on_frame(const input_data input)
+{
+    static int first_line = 0;
+    static int frames_count = 0;
+
+    //Scroll through the lines, the glyphs of the lines that scroll in are rasterized on demand
+    if (++frames_count % 30 == 0) first_line = (first_line + 1) % (CHARS_COUNT / 32);
+
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    for (int i = 0; i < 8; i++)
+    {
+        const char* text = line_text[(first_line + i) % (CHARS_COUNT / 32)];
+        rf_draw_text_cached(&font_cache, text, (rf_vector2){ 20, 60 + i * 40 }, FONT_SIZE, 1, rf_darkgray);
+    }
+
+    char stats[256];
+    snprintf(stats, sizeof(stats), "glyphs cached: %i  pages: %i/%i  pages evicted: %i",
+             font_cache.glyphs_count, font_cache.pages_count, font_cache.max_pages, font_cache.pages_evicted);
+    rf_draw_text(stats, 10, 10, 10, rf_maroon);
+
+    rf_draw_fps(10, 30);
+
+    rf_end_drawing();
+}
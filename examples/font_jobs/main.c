@@ -0,0 +1,133 @@
+//Font jobs example: loads a TTF font at several sizes with the glyphs rasterized on the calling thread, then again with
+//a job system running them on worker threads (rf_set_job_system), 4 workers unless given on the command line
+//The load times are printed and the atlases of both runs are compared, they must be the same for any number of threads
+//Usage: font_jobs [worker count]
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define FONT_PATH "../../../examples/assets/KAISG.ttf"
+#define FONTS_COUNT 3 // The same font stands in for the fonts of a game
+#define CHARS_COUNT 448 // Basic Latin to Latin Extended-A and B
+#define MAX_WORKERS 64
+
+#define SIZES_COUNT 4
+int font_sizes[SIZES_COUNT] = { 16, 24, 32, 64 };
+
+int worker_count = 4;
+
+// A parallel for of the job system: every worker takes the next index until all are done
+typedef struct parallel_for_job
+{
+    rf_job_proc proc;
+    void* data;
+    int count;
+    volatile long next;
+} parallel_for_job;
+
+#if defined(_WIN32)
+long take_next_index(parallel_for_job* job) { return InterlockedIncrement(&job->next) - 1; }
+#else
+long take_next_index(parallel_for_job* job) { return __sync_fetch_and_add(&job->next, 1); }
+#endif
+
+void run_jobs(parallel_for_job* job)
+{
+    for (long i = take_next_index(job); i < job->count; i = take_next_index(job)) job->proc(job->data, (int)i);
+}
+
+#if defined(_WIN32)
+DWORD WINAPI worker(LPVOID arg) { run_jobs((parallel_for_job*)arg); return 0; }
+#else
+void* worker(void* arg) { run_jobs((parallel_for_job*)arg); return NULL; }
+#endif
+
+// Threads are started for every parallel for to keep the example short, a game would keep a thread pool around
+void parallel_for(void* user_data, rf_job_proc proc, void* data, int count)
+{
+    parallel_for_job job = { proc, data, count, 0 };
+
+#if defined(_WIN32)
+    HANDLE threads[MAX_WORKERS];
+    for (int i = 0; i < worker_count; i++) threads[i] = CreateThread(NULL, 0, worker, &job, 0, NULL);
+    WaitForMultipleObjects(worker_count, threads, TRUE, INFINITE);
+    for (int i = 0; i < worker_count; i++) CloseHandle(threads[i]);
+#else
+    pthread_t threads[MAX_WORKERS];
+    for (int i = 0; i < worker_count; i++) pthread_create(&threads[i], NULL, worker, &job);
+    for (int i = 0; i < worker_count; i++) pthread_join(threads[i], NULL);
+#endif
+}
+
+// Load all the fonts, returns the load time in seconds
+double load_fonts(rf_load_font_async_result* fonts, int* font_chars)
+{
+    double start = rf_get_time();
+
+    for (int i = 0; i < FONTS_COUNT * SIZES_COUNT; i++)
+    {
+        fonts[i] = rf_load_font_async(FONT_PATH, font_sizes[i % SIZES_COUNT], font_chars, CHARS_COUNT);
+    }
+
+    return rf_get_time() - start;
+}
+
+void unload_fonts(rf_load_font_async_result* fonts)
+{
+    for (int i = 0; i < FONTS_COUNT * SIZES_COUNT; i++)
+    {
+        for (int c = 0; c < fonts[i].font.chars_count; c++) rf_unload_image(fonts[i].font.chars[c].image);
+        RF_FREE(fonts[i].font.chars);
+        RF_FREE(fonts[i].font.recs);
+        RF_FREE(fonts[i].font.glyph_map);
+        RF_FREE(fonts[i].font.kerning);
+        rf_unload_image(fonts[i].atlas);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1) worker_count = atoi(argv[1]);
+    if (worker_count < 1) worker_count = 1;
+    if (worker_count > MAX_WORKERS) worker_count = MAX_WORKERS;
+
+    int font_chars[CHARS_COUNT];
+    for (int i = 0; i < CHARS_COUNT; i++) font_chars[i] = 32 + i;
+
+    rf_load_font_async_result serial_fonts[FONTS_COUNT * SIZES_COUNT];
+    rf_load_font_async_result parallel_fonts[FONTS_COUNT * SIZES_COUNT];
+
+    rf_set_job_system((rf_job_system) { 0 });
+    double serial_time = load_fonts(serial_fonts, font_chars);
+
+    rf_set_job_system((rf_job_system) { parallel_for, NULL });
+    double parallel_time = load_fonts(parallel_fonts, font_chars);
+
+    int mismatches = 0;
+    for (int i = 0; i < FONTS_COUNT * SIZES_COUNT; i++)
+    {
+        rf_image a = serial_fonts[i].atlas;
+        rf_image b = parallel_fonts[i].atlas;
+        int size = a.width * a.height * 2; // Gray alpha atlas
+
+        if (a.width != b.width || a.height != b.height || memcmp(a.data, b.data, size) != 0) mismatches++;
+    }
+
+    printf("%i fonts x %i sizes, %i chars each\n", FONTS_COUNT, SIZES_COUNT, CHARS_COUNT);
+    printf("calling thread: %.1f ms\n", serial_time * 1000.0);
+    printf("%i workers:      %.1f ms (%.2fx)\n", worker_count, parallel_time * 1000.0, serial_time / parallel_time);
+    printf("atlas mismatches: %i\n", mismatches);
+
+    unload_fonts(serial_fonts);
+    unload_fonts(parallel_fonts);
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+//Font kerning example: draws and measures the same lines of text with a TTF font using its kerning pairs and with a copy of
+//the font without them (kerning_count 0), the CPU time of both is averaged over the frames and drawn on top
+//The lines alternate between the two fonts, every line with kerning is followed by the same line without it
+//The kerning pairs are found once at load, the text functions look every pair of characters up in the font kerning hash
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define FONT_PATH "../../../examples/assets/KAISG.ttf"
+#define FONT_SIZE 20
+#define LINES_COUNT 200 // Lines drawn with each font every frame, most of them off screen
+#define MEASURES_COUNT 1000 // Lines measured with each font every frame
+
+rf_font font_kerning;
+rf_font font_plain;
+
+const char* line = "AVATAR Today, WAVE yoTTo. Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+
+double kerning_draw_time, plain_draw_time;
+double kerning_measure_time, plain_measure_time;
+int frames;
+
+volatile float measured_width; // The measured widths end here so the measuring loops aren't optimized out
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    font_kerning = rf_load_font_ex(FONT_PATH, FONT_SIZE, NULL, 95);
+
+    //The copy shares the glyphs and atlas, only the kerning is left out
+    font_plain = font_kerning;
+    font_plain.kerning = NULL;
+    font_plain.kerning_map_size = 0;
+    font_plain.kerning_count = 0;
+
+    printf("%i kerning pairs\n", font_kerning.kerning_count);
+}
+
+// Draw all the lines with a font, every other line starting at first_line (0 or 1), returns the time in seconds
+double draw_lines(rf_font font, int first_line, rf_color color)
+{
+    double start = rf_get_time();
+
+    for (int i = 0; i < LINES_COUNT; i++)
+    {
+        rf_draw_text_ex(font, line, (rf_vector2){ 10, 60 + (2 * i + first_line) * FONT_SIZE }, FONT_SIZE, 0, color);
+    }
+
+    return rf_get_time() - start;
+}
+
+// Measure the line many times with a font, returns the time in seconds
+double measure_lines(rf_font font)
+{
+    double start = rf_get_time();
+
+    float width = 0;
+    for (int i = 0; i < MEASURES_COUNT; i++) width += rf_measure_text_ex(font, line, FONT_SIZE, 0).x;
+
+    double time = rf_get_time() - start;
+
+    measured_width = width;
+
+    return time;
+}
+
+void on_frame(const input_data input)
+{
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    kerning_draw_time += draw_lines(font_kerning, 0, rf_darkblue);
+    plain_draw_time += draw_lines(font_plain, 1, rf_maroon);
+    kerning_measure_time += measure_lines(font_kerning);
+    plain_measure_time += measure_lines(font_plain);
+    frames++;
+
+    char info[256];
+    snprintf(info, sizeof(info), "%i lines drawn: %.3f ms with kerning, %.3f ms without",
+             LINES_COUNT, kerning_draw_time * 1000.0 / frames, plain_draw_time * 1000.0 / frames);
+    rf_draw_text(info, 10, 10, 10, rf_maroon);
+
+    snprintf(info, sizeof(info), "%i lines measured: %.3f ms with kerning, %.3f ms without",
+             MEASURES_COUNT, kerning_measure_time * 1000.0 / frames, plain_measure_time * 1000.0 / frames);
+    rf_draw_text(info, 10, 24, 10, rf_maroon);
+
+    rf_draw_fps(10, 38);
+
+    rf_end_drawing();
+}
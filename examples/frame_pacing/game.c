@@ -0,0 +1,75 @@
+//Frame pacing example: paces frames at TARGET_FPS with rf_set_target_fps and prints the jitter histogram of the frame pacer
+//NOTE: Disable vsync in the driver, otherwise the swap interval paces the frames instead of rayfork
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define TARGET_FPS 144
+#define BAR_WIDTH 20
+
+int frames_count;
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    rf_set_target_fps(TARGET_FPS);
+}
+
+void on_frame(const input_data input)
+{
+    rf_frame_pacing_stats stats = rf_get_frame_pacing_stats();
+
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Histogram of the wake up delays past the frame target, one bar per bucket
+    int max_count = 1;
+    for (int i = 0; i < rf_frame_jitter_buckets; i++) if (stats.jitter_histogram[i] > max_count) max_count = stats.jitter_histogram[i];
+
+    for (int i = 0; i < rf_frame_jitter_buckets; i++)
+    {
+        int height = stats.jitter_histogram[i] * 300 / max_count;
+        rf_draw_rectangle(40 + i * BAR_WIDTH, 400 - height, BAR_WIDTH - 2, height, rf_darkblue);
+    }
+
+    int paced_frames = stats.frames - stats.missed_frames;
+
+    char text[1024];
+    snprintf(text, sizeof(text), "frames: %i  missed: %i  avg jitter: %.1f us  max jitter: %.1f us  sleep slack: %.1f us",
+             stats.frames, stats.missed_frames, paced_frames > 0 ? stats.total_jitter / paced_frames * 1e6 : 0.0,
+             stats.max_jitter * 1e6, stats.sleep_slack * 1e6);
+    rf_draw_text(text, 10, 10, 10, rf_darkgray);
+
+    snprintf(text, sizeof(text), "0 us .. %i us per bar", (int)(rf_frame_jitter_bucket_width * 1e6));
+    rf_draw_text(text, 40, 410, 10, rf_darkgray);
+
+    rf_draw_fps(10, 30);
+
+    rf_end_drawing();
+
+    // Print and clear the histogram every second
+    frames_count++;
+    if (frames_count % TARGET_FPS == 0)
+    {
+        printf("frames %i, missed %i, avg jitter %.1f us, max jitter %.1f us, sleep slack %.1f us\n  histogram:",
+               stats.frames, stats.missed_frames, paced_frames > 0 ? stats.total_jitter / paced_frames * 1e6 : 0.0,
+               stats.max_jitter * 1e6, stats.sleep_slack * 1e6);
+        for (int i = 0; i < rf_frame_jitter_buckets; i++) printf(" %i", stats.jitter_histogram[i]);
+        printf("\n");
+
+        rf_reset_frame_pacing_stats();
+    }
+}
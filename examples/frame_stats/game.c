@@ -0,0 +1,98 @@
+//Frame stats example: draws a scene that forces batch flushes for different reasons and prints the frame statistics
+//Every STATS_INTERVAL frames the averages per frame are printed, including why the batch was flushed
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define STATS_INTERVAL 120 // Frames between printed averages
+#define ICON_COUNT 64
+
+rf_texture2d icon_texture;
+
+int            frames_count;
+rf_frame_stats interval_stats;
+
+const char* flush_reason_names[rf_flush_reason_count] = { "explicit", "buffer full", "texture change", "mode change", "layer change", "matrix pop" };
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    icon_texture = rf_load_texture("../../../examples/assets/wabbit_alpha.png");
+
+    rf_gl_enable_gpu_timer();
+}
+
+void on_frame(const input_data input)
+{
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Icons and rectangles interleaved, every switch between the icon texture and the default texture splits the batch
+    for (int i = 0; i < ICON_COUNT; i++)
+    {
+        int x = 20 + (i % 16) * 48;
+        int y = 60 + (i / 16) * 48;
+
+        rf_draw_rectangle(x - 2, y - 2, 36, 36, rf_lightgray);
+        rf_draw_texture(icon_texture, x, y, rf_white);
+    }
+
+    // Lines and triangles in between change the draw mode
+    for (int i = 0; i < 16; i++)
+    {
+        rf_draw_line(20 + i * 48, 280, 52 + i * 48, 312, rf_maroon);
+        rf_draw_triangle((rf_vector2){ 20 + i * 48, 340 }, (rf_vector2){ 36 + i * 48, 372 }, (rf_vector2){ 52 + i * 48, 340 }, rf_darkblue);
+    }
+
+    rf_frame_stats stats = rf_get_frame_stats(); // Stats of the previous frame
+
+    char text[1024];
+    snprintf(text, sizeof(text), "draw calls: %i  flushes: %i  texture binds: %i  uploaded: %i bytes  cpu: %.3f ms  gpu: %.3f ms",
+             stats.draw_calls, stats.flushes, stats.texture_binds, stats.bytes_uploaded, stats.cpu_time * 1000.0, stats.gpu_time * 1000.0);
+    rf_draw_text(text, 10, 10, 10, rf_darkgray);
+
+    rf_draw_fps(10, 30);
+
+    rf_end_drawing();
+
+    // Accumulate the stats of the frame just drawn
+    stats = rf_get_frame_stats();
+    interval_stats.draw_calls += stats.draw_calls;
+    interval_stats.vertices += stats.vertices;
+    interval_stats.flushes += stats.flushes;
+    interval_stats.texture_binds += stats.texture_binds;
+    interval_stats.shader_switches += stats.shader_switches;
+    interval_stats.bytes_uploaded += stats.bytes_uploaded;
+    interval_stats.cpu_time += stats.cpu_time;
+    interval_stats.gpu_time += stats.gpu_time;
+    for (int i = 0; i < rf_flush_reason_count; i++) interval_stats.flush_reasons[i] += stats.flush_reasons[i];
+
+    frames_count++;
+    if (frames_count % STATS_INTERVAL == 0)
+    {
+        printf("avg/frame: draw calls %.1f, vertices %.1f, texture binds %.1f, shader switches %.1f, uploaded %.1f bytes, cpu %.3f ms, gpu %.3f ms\n",
+               (double)interval_stats.draw_calls / STATS_INTERVAL, (double)interval_stats.vertices / STATS_INTERVAL,
+               (double)interval_stats.texture_binds / STATS_INTERVAL, (double)interval_stats.shader_switches / STATS_INTERVAL,
+               (double)interval_stats.bytes_uploaded / STATS_INTERVAL,
+               interval_stats.cpu_time * 1000.0 / STATS_INTERVAL, interval_stats.gpu_time * 1000.0 / STATS_INTERVAL);
+
+        printf("  flushes %.1f:", (double)interval_stats.flushes / STATS_INTERVAL);
+        for (int i = 0; i < rf_flush_reason_count; i++) printf(" %s %.1f", flush_reason_names[i], (double)interval_stats.flush_reasons[i] / STATS_INTERVAL);
+        printf("\n");
+
+        interval_stats = (rf_frame_stats){ 0 };
+    }
+}
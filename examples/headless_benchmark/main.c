@@ -0,0 +1,94 @@
+//Headless benchmark: draws shapes, sprites and text through the null GL backend, no window or OpenGL context is needed
+//The CPU time per frame and the calls reaching the backend are printed, the first frame can be recorded to a file
+//Usage: headless_benchmark [frames] [record file]
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#define RF_GL_BACKEND
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 450
+#define DEFAULT_FRAMES 1000
+#define SHAPES_PER_FRAME 2000
+#define SPRITES_PER_FRAME 2000
+
+rf_context rf_ctx;
+rf_texture2d sprite_texture;
+
+void draw_frame(int frame)
+{
+    rf_begin_drawing();
+
+        rf_clear_background(rf_raywhite);
+
+        for (int i = 0; i < SHAPES_PER_FRAME; i++)
+        {
+            int x = (i * 37 + frame) % SCREEN_WIDTH;
+            int y = (i * 91) % SCREEN_HEIGHT;
+
+            if (i % 2) rf_draw_rectangle(x, y, 8, 8, rf_red);
+            else rf_draw_circle(x, y, 4.0f, rf_blue);
+        }
+
+        for (int i = 0; i < SPRITES_PER_FRAME; i++)
+        {
+            rf_draw_texture(sprite_texture, (i * 53 + frame) % SCREEN_WIDTH, (i * 17) % SCREEN_HEIGHT, rf_white);
+        }
+
+        rf_draw_text("Headless benchmark", 10, 10, 20, rf_darkgray);
+
+    rf_end_drawing();
+}
+
+int main(int argc, char** argv)
+{
+    int frames = (argc > 1)? atoi(argv[1]) : DEFAULT_FRAMES;
+    const char* record_file = (argc > 2)? argv[2] : NULL;
+
+    if (frames <= 0) frames = DEFAULT_FRAMES;
+
+    //The recording backend logs the first frame, the rest run on the null backend
+    if (!rf_gl_set_backend(record_file ? rf_gl_backend_recording : rf_gl_backend_null, record_file)) return 1;
+
+    rf_context_init(&rf_ctx, SCREEN_WIDTH, SCREEN_HEIGHT);
+    rf_load_font_default();
+
+    rf_image sprite_image = rf_gen_image_checked(16, 16, 4, 4, rf_orange, rf_maroon);
+    sprite_texture = rf_load_texture_from_image(sprite_image);
+    rf_unload_image(sprite_image);
+
+    if (record_file)
+    {
+        draw_frame(0);
+        rf_gl_set_backend(rf_gl_backend_null, NULL);
+        printf("First frame recorded to %s\n", record_file);
+    }
+
+    double elapsed = 0.0;
+    double calls = 0.0;
+    double draw_calls = 0.0;
+    double uploaded_bytes = 0.0;
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        rf_gl_reset_backend_stats();
+
+        double start = rf_get_time();
+        draw_frame(frame);
+        elapsed += rf_get_time() - start;
+
+        //The backend stats are collected every frame so the counters don't overflow on long runs
+        rf_gl_backend_stats stats = rf_gl_get_backend_stats();
+        calls += stats.calls;
+        draw_calls += stats.draw_calls;
+        uploaded_bytes += stats.uploaded_bytes;
+    }
+
+    printf("%d frames, %.3f ms per frame (CPU)\n", frames, elapsed * 1000.0 / frames);
+    printf("Per frame: %.1f GL calls, %.1f draw calls, %.1f KB uploaded\n",
+           calls / frames, draw_calls / frames, uploaded_bytes / frames / 1024.0);
+
+    return 0;
+}
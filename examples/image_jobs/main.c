@@ -0,0 +1,155 @@
+//Image jobs example: runs the image functions on a 4K image on the calling thread, then again with a job system running
+//them on worker threads (rf_set_job_system), 4 workers unless given on the command line
+//The times of both runs are printed and the images compared, they must be the same for any number of threads
+//Usage: image_jobs [worker count]
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define MAX_WORKERS 64
+
+int image_width = 3840;
+int image_height = 2160;
+int worker_count = 4;
+
+// A parallel for of the job system: every worker takes the next index until all are done
+typedef struct parallel_for_job
+{
+    rf_job_proc proc;
+    void* data;
+    int count;
+    volatile long next;
+} parallel_for_job;
+
+#if defined(_WIN32)
+long take_next_index(parallel_for_job* job) { return InterlockedIncrement(&job->next) - 1; }
+#else
+long take_next_index(parallel_for_job* job) { return __sync_fetch_and_add(&job->next, 1); }
+#endif
+
+void run_jobs(parallel_for_job* job)
+{
+    for (long i = take_next_index(job); i < job->count; i = take_next_index(job)) job->proc(job->data, (int)i);
+}
+
+#if defined(_WIN32)
+DWORD WINAPI worker(LPVOID arg) { run_jobs((parallel_for_job*)arg); return 0; }
+#else
+void* worker(void* arg) { run_jobs((parallel_for_job*)arg); return NULL; }
+#endif
+
+// Threads are started for every parallel for to keep the example short, a game would keep a thread pool around
+void parallel_for(void* user_data, rf_job_proc proc, void* data, int count)
+{
+    parallel_for_job job = { proc, data, count, 0 };
+
+#if defined(_WIN32)
+    HANDLE threads[MAX_WORKERS];
+    for (int i = 0; i < worker_count; i++) threads[i] = CreateThread(NULL, 0, worker, &job, 0, NULL);
+    WaitForMultipleObjects(worker_count, threads, TRUE, INFINITE);
+    for (int i = 0; i < worker_count; i++) CloseHandle(threads[i]);
+#else
+    pthread_t threads[MAX_WORKERS];
+    for (int i = 0; i < worker_count; i++) pthread_create(&threads[i], NULL, worker, &job);
+    for (int i = 0; i < worker_count; i++) pthread_join(threads[i], NULL);
+#endif
+}
+
+rf_image source;
+
+rf_image to_r5g6b5(void) { rf_image image = rf_image_copy(source); rf_image_format(&image, rf_uncompressed_r5g6b5); return image; }
+rf_image to_grayscale(void) { rf_image image = rf_image_copy(source); rf_image_format(&image, rf_uncompressed_grayscale); return image; }
+rf_image tint(void) { rf_image image = rf_image_copy(source); rf_image_color_tint(&image, (rf_color){ 200, 150, 100, 255 }); return image; }
+rf_image contrast(void) { rf_image image = rf_image_copy(source); rf_image_color_contrast(&image, 30); return image; }
+rf_image resize_nn(void) { rf_image image = rf_image_copy(source); rf_image_resize_nn(&image, image_width * 3 / 4, image_height * 3 / 4); return image; }
+rf_image dither(void) { rf_image image = rf_image_copy(source); rf_image_dither(&image, 5, 6, 5, 0); return image; }
+rf_image perlin_noise(void) { return rf_gen_image_perlin_noise(image_width / 2, image_height / 2, 0, 0, 4.0f); }
+rf_image cellular(void) { srand(1); return rf_gen_image_cellular(image_width / 2, image_height / 2, 32); }
+
+typedef struct image_job
+{
+    const char* name;
+    rf_image (*proc)(void);
+} image_job;
+
+image_job jobs[] = {
+    { "format r5g6b5", to_r5g6b5 },
+    { "format grayscale", to_grayscale },
+    { "tint", tint },
+    { "contrast", contrast },
+    { "resize nn (3/4)", resize_nn },
+    { "dither 565", dither },
+    { "perlin noise (1/4)", perlin_noise },
+    { "cellular (1/4)", cellular },
+};
+#define JOBS_COUNT 8
+
+// Run a job, returns the time in seconds
+double run_job(image_job job, rf_image* result)
+{
+    double start = rf_get_time();
+    *result = job.proc();
+    return rf_get_time() - start;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1) worker_count = atoi(argv[1]);
+    if (worker_count < 1) worker_count = 1;
+    if (worker_count > MAX_WORKERS) worker_count = MAX_WORKERS;
+
+    //Source image with a gradient and some noise
+    rf_color* pixels = (rf_color*) malloc(image_width * image_height * sizeof(rf_color));
+    unsigned int random_state = 12345;
+
+    for (int i = 0; i < image_width * image_height; i++)
+    {
+        random_state = random_state * 1103515245 + 12345;
+        pixels[i] = (rf_color){ (i % image_width) * 255 / image_width, (i / image_width) * 255 / image_height, (random_state >> 24) & 0x3f, 255 };
+    }
+
+    source = rf_load_image_ex(pixels, image_width, image_height);
+    free(pixels);
+
+    printf("%ix%i image, %i workers\n", image_width, image_height, worker_count);
+    printf("%-20s %14s %14s %9s\n", "function", "calling thread", "workers", "speedup");
+
+    int mismatches = 0;
+
+    for (int i = 0; i < JOBS_COUNT; i++)
+    {
+        rf_image serial, parallel;
+
+        rf_set_job_system((rf_job_system) { 0 });
+        double serial_time = run_job(jobs[i], &serial);
+
+        rf_set_job_system((rf_job_system) { parallel_for, NULL });
+        double parallel_time = run_job(jobs[i], &parallel);
+
+        int size = rf_get_pixel_data_size(serial.width, serial.height, serial.format);
+        bool same = (serial.width == parallel.width) && (serial.height == parallel.height) && (serial.format == parallel.format) &&
+                    (memcmp(serial.data, parallel.data, size) == 0);
+
+        printf("%-20s %11.1f ms %11.1f ms %8.2fx%s\n", jobs[i].name, serial_time * 1000.0, parallel_time * 1000.0,
+               serial_time / parallel_time, same ? "" : "  (images differ)");
+
+        if (!same) mismatches++;
+
+        rf_unload_image(serial);
+        rf_unload_image(parallel);
+    }
+
+    rf_unload_image(source);
+
+    printf("image mismatches: %i\n", mismatches);
+
+    return mismatches == 0 ? 0 : 1;
+}
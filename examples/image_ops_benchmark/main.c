@@ -0,0 +1,159 @@
+//Image operations benchmark: runs the rf_image_* operations on 4K images in grayscale, R8G8B8 and R8G8B8A8
+//For every operation and format the time per pixel and the memory allocated by rayfork (counted through RF_MALLOC) are printed
+//The "tint (round trip)" line is the tint done the old way, through rf_get_image_data, rf_load_image_ex and rf_image_format
+//Usage: image_ops_benchmark [width height]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//Count the allocations rayfork makes
+int allocations_count;
+long long allocated_bytes;
+
+void* counted_malloc(size_t size)
+{
+    allocations_count++;
+    allocated_bytes += size;
+    return malloc(size);
+}
+
+#define RF_MALLOC(sz) counted_malloc(sz)
+#define RF_FREE(p) free(p)
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define BENCHMARK_MIN_TIME 0.5
+#define FORMATS_COUNT 3
+
+int image_width = 3840;
+int image_height = 2160;
+
+void round_trip_tint(rf_image* image)
+{
+    rf_color* pixels = rf_get_image_data(*image);
+
+    for (int i = 0; i < image->width * image->height; i++)
+    {
+        pixels[i].r = (unsigned char)(pixels[i].r * 200 / 255);
+        pixels[i].g = (unsigned char)(pixels[i].g * 150 / 255);
+        pixels[i].b = (unsigned char)(pixels[i].b * 100 / 255);
+    }
+
+    rf_image processed = rf_load_image_ex(pixels, image->width, image->height);
+    rf_image_format(&processed, image->format);
+    rf_unload_image(*image);
+    RF_FREE(pixels);
+
+    image->data = processed.data;
+}
+
+void tint(rf_image* image) { rf_image_color_tint(image, (rf_color){ 200, 150, 100, 255 }); }
+void invert(rf_image* image) { rf_image_color_invert(image); }
+void contrast(rf_image* image) { rf_image_color_contrast(image, 30); }
+void brightness(rf_image* image) { rf_image_color_brightness(image, 40); }
+void replace(rf_image* image) { rf_image_color_replace(image, (rf_color){ 255, 255, 255, 255 }, rf_blank); }
+void flip_vertical(rf_image* image) { rf_image_flip_vertical(image); }
+void flip_horizontal(rf_image* image) { rf_image_flip_horizontal(image); }
+void rotate_cw(rf_image* image) { rf_image_rotate_cw(image); }
+void resize_nn(rf_image* image) { rf_image_resize_nn(image, image->width / 2, image->height / 2); }
+void dither(rf_image* image) { rf_image_dither(image, 5, 6, 5, 0); }
+
+typedef struct image_op
+{
+    const char* name;
+    void (*proc)(rf_image* image);
+} image_op;
+
+image_op ops[] = {
+    { "tint (round trip)", round_trip_tint },
+    { "tint", tint },
+    { "invert", invert },
+    { "contrast", contrast },
+    { "brightness", brightness },
+    { "replace", replace },
+    { "flip vertical", flip_vertical },
+    { "flip horizontal", flip_horizontal },
+    { "rotate cw", rotate_cw },
+    { "resize nn (half)", resize_nn },
+    { "dither 565", dither },
+};
+#define OPS_COUNT 11
+
+//Source image with a gradient and some noise, so replace has white pixels to find
+rf_image make_image(int format)
+{
+    rf_color* pixels = (rf_color*) malloc(image_width * image_height * sizeof(rf_color));
+    unsigned int random_state = 12345;
+
+    for (int y = 0; y < image_height; y++)
+    {
+        for (int x = 0; x < image_width; x++)
+        {
+            random_state = random_state * 1103515245 + 12345;
+            unsigned char noise = (random_state >> 16) & 0x3f;
+            pixels[y * image_width + x] = ((random_state >> 24) < 16) ? rf_white : (rf_color){ x * 255 / image_width, y * 255 / image_height, noise, 255 };
+        }
+    }
+
+    rf_image image = rf_load_image_ex(pixels, image_width, image_height);
+    rf_image_format(&image, format);
+    free(pixels);
+
+    return image;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        image_width = atoi(argv[1]);
+        image_height = atoi(argv[2]);
+    }
+
+    int formats[FORMATS_COUNT] = { rf_uncompressed_grayscale, rf_uncompressed_r8g8b8, rf_uncompressed_r8g8b8a8 };
+    const char* format_names[FORMATS_COUNT] = { "gray", "rgb", "rgba" };
+    double pixels = (double)image_width * image_height;
+
+    printf("%ix%i images\n", image_width, image_height);
+    printf("%-20s %-6s %10s %8s %12s\n", "operation", "format", "ns/pixel", "allocs", "MB allocated");
+
+    for (int f = 0; f < FORMATS_COUNT; f++)
+    {
+        rf_image source = make_image(formats[f]);
+
+        for (int o = 0; o < OPS_COUNT; o++)
+        {
+            double time = 0;
+            int runs = 0;
+            int allocations = 0;
+            long long bytes = 0;
+
+            while ((time < BENCHMARK_MIN_TIME) || (runs == 0))
+            {
+                rf_image image = rf_image_copy(source);
+
+                allocations_count = 0;
+                allocated_bytes = 0;
+
+                double start = rf_get_time();
+                ops[o].proc(&image);
+                time += rf_get_time() - start;
+
+                allocations = allocations_count;
+                bytes = allocated_bytes;
+                runs++;
+
+                rf_unload_image(image);
+            }
+
+            printf("%-20s %-6s %10.2f %8i %12.1f\n", ops[o].name, format_names[f], time * 1e9 / (runs * pixels), allocations, bytes / (1024.0 * 1024.0));
+        }
+
+        rf_unload_image(source);
+    }
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+//Image stream resize example: writes a big R8G8B8A8 RAW image file and loads it downscaled twice, once the old way with
+//rf_load_image_raw and rf_image_resize and once with rf_load_image_raw_resized, which reads the file in strips of rows
+//The time and the peak memory allocated by rayfork (counted through RF_MALLOC and RF_FREE) are printed for both
+//Usage: image_stream_resize [width height new_width new_height]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//Count the memory rayfork holds, every allocation keeps its size in front of it
+long long allocated_bytes;
+long long peak_bytes;
+
+void* counted_malloc(size_t size)
+{
+    long long* block = (long long*) malloc(size + sizeof(long long));
+    if (block == NULL) return NULL;
+
+    block[0] = size;
+    allocated_bytes += size;
+    if (allocated_bytes > peak_bytes) peak_bytes = allocated_bytes;
+
+    return block + 1;
+}
+
+void counted_free(void* p)
+{
+    if (p == NULL) return;
+
+    long long* block = (long long*) p - 1;
+    allocated_bytes -= block[0];
+    free(block);
+}
+
+#define RF_MALLOC(sz) counted_malloc(sz)
+#define RF_FREE(p) counted_free(p)
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define RAW_PATH "image_stream_resize.raw"
+
+int image_width = 8192;
+int image_height = 8192;
+int new_width = 1024;
+int new_height = 1024;
+
+//Write the RAW file a row at a time, a gradient with some noise
+void write_raw_file(void)
+{
+    FILE* file = fopen(RAW_PATH, "wb");
+    rf_color* row = (rf_color*) malloc(image_width * sizeof(rf_color));
+    unsigned int random_state = 12345;
+
+    for (int y = 0; y < image_height; y++)
+    {
+        for (int x = 0; x < image_width; x++)
+        {
+            random_state = random_state * 1103515245 + 12345;
+            row[x] = (rf_color){ x * 255 / image_width, y * 255 / image_height, (random_state >> 16) & 0xff, 255 };
+        }
+
+        fwrite(row, sizeof(rf_color), image_width, file);
+    }
+
+    free(row);
+    fclose(file);
+}
+
+rf_image load_full_and_resize(void)
+{
+    rf_image image = rf_load_image_raw(RAW_PATH, image_width, image_height, rf_uncompressed_r8g8b8a8, 0);
+    rf_image_resize(&image, new_width, new_height);
+    return image;
+}
+
+rf_image load_streamed(void)
+{
+    return rf_load_image_raw_resized(RAW_PATH, image_width, image_height, rf_uncompressed_r8g8b8a8, 0, new_width, new_height);
+}
+
+void run(const char* name, rf_image (*load)(void))
+{
+    allocated_bytes = 0;
+    peak_bytes = 0;
+
+    double start = rf_get_time();
+    rf_image image = load();
+    double time = rf_get_time() - start;
+
+    //The mip chain is generated from the small image
+    rf_image_mipmaps(&image);
+
+    printf("%-28s %10.1f ms %10.1f MB peak, %ix%i with %i mipmaps\n", name, time * 1000.0, peak_bytes / (1024.0 * 1024.0), image.width, image.height, image.mipmaps);
+
+    rf_unload_image(image);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 4)
+    {
+        image_width = atoi(argv[1]);
+        image_height = atoi(argv[2]);
+        new_width = atoi(argv[3]);
+        new_height = atoi(argv[4]);
+    }
+
+    printf("%ix%i RAW image resized to %ix%i\n", image_width, image_height, new_width, new_height);
+
+    write_raw_file();
+
+    run("rf_load_image_raw + resize", load_full_and_resize);
+    run("rf_load_image_raw_resized", load_streamed);
+
+    remove(RAW_PATH);
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+//Palette benchmark: the steps of a palette swap effect on a capture, timed per run
+//rf_image_extract_palette finds the colors of a pixel art image, rf_image_quantize_palette chooses 256 colors for a photo
+//like image and rf_image_to_indexed maps the image to its palette, with and without dithering
+//The error of the indexed image against the source is printed as the root mean square of the channels
+//Usage: palette_benchmark [width height]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define BENCHMARK_MIN_TIME 0.5
+
+int image_width = 512;
+int image_height = 512;
+
+rf_image photo;
+rf_image pixel_art;
+rf_color* palette;
+int palette_count;
+rf_image indexed;
+
+//Photo like image, smooth gradients with some noise
+rf_image make_photo(void)
+{
+    rf_color* pixels = (rf_color*) malloc(image_width * image_height * sizeof(rf_color));
+    unsigned int random_state = 12345;
+
+    for (int y = 0; y < image_height; y++)
+    {
+        for (int x = 0; x < image_width; x++)
+        {
+            random_state = random_state * 1103515245 + 12345;
+            pixels[y * image_width + x] = (rf_color){ x * 255 / image_width, y * 255 / image_height, ((x * y) / image_width + ((random_state >> 16) & 15)) & 255, 255 };
+        }
+    }
+
+    rf_image image = rf_load_image_ex(pixels, image_width, image_height);
+    free(pixels);
+
+    return image;
+}
+
+//Pixel art image, 8x8 blocks of 32 colors and transparent pixels
+rf_image make_pixel_art(void)
+{
+    rf_color colors[32];
+    for (int i = 0; i < 32; i++) colors[i] = (rf_color){ (i * 97) & 255, (i * 53) & 255, (i * 29) & 255, 255 };
+
+    rf_color* pixels = (rf_color*) malloc(image_width * image_height * sizeof(rf_color));
+
+    for (int y = 0; y < image_height; y++)
+    {
+        for (int x = 0; x < image_width; x++)
+        {
+            int block = (x / 8) * 7 + (y / 8) * 3;
+            pixels[y * image_width + x] = (block % 11 == 0) ? rf_blank : colors[block % 32];
+        }
+    }
+
+    rf_image image = rf_load_image_ex(pixels, image_width, image_height);
+    free(pixels);
+
+    return image;
+}
+
+void extract(void)
+{
+    RF_FREE(palette);
+    palette = rf_image_extract_palette(pixel_art, 256, &palette_count);
+}
+
+void quantize(void)
+{
+    RF_FREE(palette);
+    palette = rf_image_quantize_palette(photo, 256, &palette_count);
+}
+
+void to_indexed(void)
+{
+    rf_unload_image(indexed);
+    indexed = rf_image_to_indexed(photo, palette, palette_count, false);
+}
+
+void to_indexed_dithered(void)
+{
+    rf_unload_image(indexed);
+    indexed = rf_image_to_indexed(photo, palette, palette_count, true);
+}
+
+void run(const char* name, void (*proc)(void))
+{
+    double time = 0;
+    int runs = 0;
+
+    while (time < BENCHMARK_MIN_TIME)
+    {
+        double start = rf_get_time();
+        proc();
+        time += rf_get_time() - start;
+        runs++;
+    }
+
+    printf("%-32s %10.3f ms\n", name, time * 1000.0 / runs);
+}
+
+//Root mean square error of the indexed image channels
+double indexed_error(void)
+{
+    rf_color* pixels = rf_get_image_data(photo);
+    unsigned char* indices = (unsigned char*) indexed.data;
+    double sum = 0;
+
+    for (int i = 0; i < image_width * image_height; i++)
+    {
+        rf_color color = palette[indices[2 * i]];
+        sum += (color.r - pixels[i].r) * (color.r - pixels[i].r) + (color.g - pixels[i].g) * (color.g - pixels[i].g) + (color.b - pixels[i].b) * (color.b - pixels[i].b);
+    }
+
+    RF_FREE(pixels);
+
+    return sqrt(sum / (3.0 * image_width * image_height));
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        image_width = atoi(argv[1]);
+        image_height = atoi(argv[2]);
+    }
+
+    photo = make_photo();
+    pixel_art = make_pixel_art();
+
+    printf("%ix%i images\n", image_width, image_height);
+
+    run("rf_image_extract_palette", extract);
+    printf("%i colors in the pixel art image\n", palette_count);
+
+    run("rf_image_quantize_palette", quantize);
+    run("rf_image_to_indexed", to_indexed);
+    printf("%i colors, error %.2f\n", palette_count, indexed_error());
+
+    run("rf_image_to_indexed (dithered)", to_indexed_dithered);
+    printf("%i colors, error %.2f\n", palette_count, indexed_error());
+
+    RF_FREE(palette);
+    rf_unload_image(indexed);
+    rf_unload_image(photo);
+    rf_unload_image(pixel_art);
+
+    return 0;
+}
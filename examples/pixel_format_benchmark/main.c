@@ -0,0 +1,107 @@
+//Pixel format benchmark: converts a 4K image between every pair of uncompressed formats with rf_convert_pixels and with
+//rf_convert_pixels_reference, the scalar conversion through normalized floats, and prints the time per pixel of both
+//The output of both must be the same bytes, the pairs where it isn't are counted and printed at the end
+//Usage: pixel_format_benchmark [width height]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define BENCHMARK_MIN_TIME 0.2
+#define FORMATS_COUNT 10
+
+int image_width = 3840;
+int image_height = 2160;
+
+const char* format_names[FORMATS_COUNT + 1] = { "", "gray", "gray_alpha", "r5g6b5", "r8g8b8", "r5g5b5a1", "r4g4b4a4", "r8g8b8a8", "r32", "r32g32b32", "r32g32b32a32" };
+
+//Source pixels in a format, the float formats get values a bit out of [0, 1] too so the clamping is checked
+void* make_pixels(int format, int count)
+{
+    int size = rf_get_pixel_data_size(count, 1, format);
+    unsigned char* pixels = (unsigned char*) malloc(size);
+    unsigned int random_state = 12345;
+
+    for (int i = 0; i < size; i++)
+    {
+        random_state = random_state * 1103515245 + 12345;
+        pixels[i] = random_state >> 24;
+    }
+
+    if (format >= rf_uncompressed_r32)
+    {
+        for (int i = 0; i < size / 4; i++) ((float*)pixels)[i] = pixels[i] / 200.0f - 0.1f;
+    }
+
+    return pixels;
+}
+
+double time_conversion(void (*convert)(const void*, int, void*, int, int), const void* src, int src_format, void* dst, int dst_format, int count)
+{
+    double time = 0;
+    int runs = 0;
+
+    while ((time < BENCHMARK_MIN_TIME) || (runs == 0))
+    {
+        double start = rf_get_time();
+        convert(src, src_format, dst, dst_format, count);
+        time += rf_get_time() - start;
+        runs++;
+    }
+
+    return time / runs;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        image_width = atoi(argv[1]);
+        image_height = atoi(argv[2]);
+    }
+
+    int count = image_width * image_height;
+    int mismatches = 0;
+
+    printf("%ix%i pixels\n", image_width, image_height);
+    printf("%-13s %-13s %12s %12s %8s\n", "from", "to", "ns/pixel", "reference", "speedup");
+
+    for (int src_format = 1; src_format <= FORMATS_COUNT; src_format++)
+    {
+        void* src = make_pixels(src_format, count);
+
+        for (int dst_format = 1; dst_format <= FORMATS_COUNT; dst_format++)
+        {
+            if (src_format == dst_format) continue;
+
+            int size = rf_get_pixel_data_size(count, 1, dst_format);
+            void* dst = malloc(size);
+            void* reference = malloc(size);
+
+            double time = time_conversion(rf_convert_pixels, src, src_format, dst, dst_format, count);
+            double reference_time = time_conversion(rf_convert_pixels_reference, src, src_format, reference, dst_format, count);
+
+            printf("%-13s %-13s %12.2f %12.2f %7.1fx\n", format_names[src_format], format_names[dst_format],
+                   time * 1e9 / count, reference_time * 1e9 / count, reference_time / time);
+
+            if (memcmp(dst, reference, size) != 0)
+            {
+                printf("    output differs from the reference\n");
+                mismatches++;
+            }
+
+            free(dst);
+            free(reference);
+        }
+
+        free(src);
+    }
+
+    printf("%i conversions differ from the reference\n", mismatches);
+
+    return mismatches != 0;
+}
@@ -0,0 +1,84 @@
+//SDF text example: loads the same TTF font as a regular bitmap font (rf_load_font_ex) and as a distance field (rf_load_font_sdf)
+//Both are drawn at several sizes, the bitmap font blurs when scaled up while the SDF font keeps sharp edges
+//Click to cycle through the SDF text styles: plain, outline, shadow, outline and shadow
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define FONT_PATH "../../../examples/assets/KAISG.ttf"
+#define FONT_SIZE 32
+#define STYLES_COUNT 4
+
+rf_font font_bitmap;
+rf_font font_sdf;
+
+const char* style_names[STYLES_COUNT] = { "plain", "outline", "shadow", "outline and shadow" };
+rf_sdf_text_style styles[STYLES_COUNT];
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    font_bitmap = rf_load_font_ex(FONT_PATH, FONT_SIZE, NULL, 95);
+    font_sdf = rf_load_font_sdf(FONT_PATH, FONT_SIZE, NULL, 95);
+
+    rf_sdf_text_style outline = { 0 };
+    outline.outline_color = rf_black;
+    outline.outline_width = 1.5f;
+
+    rf_sdf_text_style shadow = { 0 };
+    shadow.shadow_color = (rf_color) { 0, 0, 0, 160 };
+    shadow.shadow_offset = (rf_vector2) { 1.5f, 1.5f };
+    shadow.shadow_softness = 1.0f;
+
+    rf_sdf_text_style both = shadow;
+    both.outline_color = rf_black;
+    both.outline_width = 1.0f;
+
+    styles[0] = (rf_sdf_text_style) { 0 };
+    styles[1] = outline;
+    styles[2] = shadow;
+    styles[3] = both;
+}
+
+void on_frame(const input_data input)
+{
+    static int style = 0;
+    static bool was_pressed = false;
+
+    if (input.left_mouse_button_pressed && !was_pressed) style = (style + 1) % STYLES_COUNT;
+    was_pressed = input.left_mouse_button_pressed;
+
+    rf_set_sdf_text_style(styles[style]);
+
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    float sizes[] = { 16, 32, 64, 128 };
+    float y = 40;
+    for (int i = 0; i < 4; i++)
+    {
+        rf_draw_text_ex(font_bitmap, "Bitmap", (rf_vector2){ 20, y }, sizes[i], 0, rf_darkgray);
+        rf_draw_text_ex(font_sdf, "SDF", (rf_vector2){ 20 + sizes[i] * 4, y }, sizes[i], 0, rf_orange);
+        y += sizes[i] + 10;
+    }
+
+    char info[128];
+    snprintf(info, sizeof(info), "SDF style: %s (click to change)", style_names[style]);
+    rf_draw_text(info, 10, 10, 10, rf_maroon);
+
+    rf_draw_fps(10, 24);
+
+    rf_end_drawing();
+}
@@ -0,0 +1,77 @@
+//Text layout example: draws the same block of chat lines every frame with rf_draw_text_ex and through a text layout cache
+//Click to switch between the two paths, the cpu time spent submitting the text is averaged and drawn on screen
+//The cached layouts are built once, after that every frame only copies the precomputed glyph quads into the batch
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define LINES_COUNT 40
+#define FONT_SIZE 10
+
+rf_font font;
+rf_text_layout_cache layout_cache;
+char line_text[LINES_COUNT][128];
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    font = rf_get_font_default();
+    layout_cache = rf_load_text_layout_cache(2 * LINES_COUNT);
+
+    for (int i = 0; i < LINES_COUNT; i++)
+    {
+        snprintf(line_text[i], sizeof(line_text[i]), "[player%02i] message %i: the quick brown fox jumps over the lazy dog", i % 7, i);
+    }
+}
+
+void on_frame(const input_data input)
+{
+    static bool use_layouts = true;
+    static double submit_time = 0;
+    static int frames_count = 0;
+    static int was_pressed = 0;
+
+    if (input.left_mouse_button_pressed && !was_pressed)
+    {
+        use_layouts = !use_layouts;
+        submit_time = 0;
+        frames_count = 0;
+    }
+    was_pressed = input.left_mouse_button_pressed;
+
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    double start = rf_get_time();
+
+    for (int i = 0; i < LINES_COUNT; i++)
+    {
+        rf_vector2 position = { 10 + (i % 2) * 390, 40 + (i / 2) * 20 };
+
+        if (use_layouts) rf_draw_text_layout_cached(&layout_cache, font, line_text[i], position, FONT_SIZE, 1, 0, rf_darkgray);
+        else rf_draw_text_ex(font, line_text[i], position, FONT_SIZE, 1, rf_darkgray);
+    }
+
+    submit_time += rf_get_time() - start;
+    frames_count++;
+
+    char stats[256];
+    snprintf(stats, sizeof(stats), "%s: %.3f ms per frame  layout cache hits: %i misses: %i",
+             use_layouts ? "rf_draw_text_layout_cached" : "rf_draw_text_ex", submit_time * 1000.0 / frames_count,
+             layout_cache.hits, layout_cache.misses);
+    rf_draw_text(stats, 10, 10, 10, rf_maroon);
+
+    rf_end_drawing();
+}
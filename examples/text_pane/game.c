@@ -0,0 +1,102 @@
+//Text pane example: a 100K characters text wrapped inside a pane, the line index is found once with rf_load_text_lines
+//The mouse height scrolls the pane, rf_draw_text_lines only decodes and draws the lines visible inside it
+//Click to insert a word at the top of the pane, rf_update_text_lines only wraps the lines around the edit again
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define TEXT_LENGTH 100000
+#define MAX_TEXT_LENGTH (TEXT_LENGTH + 64 * 1024) // Room for the inserted words
+#define FONT_SIZE 20
+
+const char* words[] = { "lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "sed", "do", "eiusmod", "tempor" };
+#define WORDS_COUNT 12
+
+rf_font font;
+char text[MAX_TEXT_LENGTH];
+int text_length;
+rf_text_lines lines;
+rf_rectangle pane = { 200, 40, 400, 400 };
+
+double load_time;
+double update_time;
+double draw_time;
+int frames;
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+
+    font = rf_get_font_default();
+
+    //Fill the text with words, a paragraph break every 40 words
+    for (int i = 0; text_length < TEXT_LENGTH - 16; i++)
+    {
+        text_length += snprintf(text + text_length, MAX_TEXT_LENGTH - text_length, "%s%s", words[(i * 7) % WORDS_COUNT], (i % 40 == 39) ? "\n\n" : " ");
+    }
+
+    double start = rf_get_time();
+    lines = rf_load_text_lines(font, text, FONT_SIZE, 2, pane.width);
+    load_time = rf_get_time() - start;
+}
+
+void on_frame(const input_data input)
+{
+    static bool was_pressed = false;
+
+    float max_scroll = rf_get_text_lines_height(lines) - pane.height;
+    float scroll = max_scroll * (float)input.mouse_y / screen_height;
+    if (scroll < 0) scroll = 0;
+    if (scroll > max_scroll) scroll = max_scroll;
+
+    //Insert a word at the start of the first visible line
+    if (input.left_mouse_button_pressed && !was_pressed && (text_length + 16) < MAX_TEXT_LENGTH)
+    {
+        int line = (int)(scroll / lines.line_height);
+        if (line >= lines.lines_count) line = lines.lines_count - 1;
+        int position = lines.lines[line].start;
+        const char* word = "INSERTED ";
+        int length = strlen(word);
+
+        memmove(text + position + length, text + position, text_length - position + 1);
+        memcpy(text + position, word, length);
+        text_length += length;
+
+        double start = rf_get_time();
+        rf_update_text_lines(&lines, font, text, position, 0, length);
+        update_time = rf_get_time() - start;
+    }
+    was_pressed = input.left_mouse_button_pressed;
+
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    rf_draw_rectangle_rec(pane, rf_lightgray);
+
+    double start = rf_get_time();
+    rf_begin_scissor_mode(pane.x, pane.y, pane.width, pane.height);
+    rf_draw_text_lines(lines, font, text, pane, scroll, rf_darkgray);
+    rf_end_scissor_mode();
+    draw_time += rf_get_time() - start;
+    frames++;
+
+    char info[256];
+    snprintf(info, sizeof(info), "%i bytes, %i lines. Load: %.3f ms, last update: %.3f ms, draw: %.3f ms",
+             text_length, lines.lines_count, load_time * 1000.0, update_time * 1000.0, draw_time * 1000.0 / frames);
+    rf_draw_text(info, 10, 10, 10, rf_maroon);
+
+    rf_draw_fps(10, 24);
+
+    rf_end_drawing();
+}
@@ -0,0 +1,215 @@
+//UTF-8 benchmark: checks rf_decode_utf8() and rf_validate_utf8() against the byte by byte decoder of the text functions
+//Random byte strings built from valid, truncated, overlong and out of range sequences are fuzzed first, then the
+//throughput of both decoders is printed in MB/s for ASCII, mixed Latin/Cyrillic and CJK text
+//Usage: utf8_benchmark [fuzz iterations]
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+
+#define DEFAULT_FUZZ_ITERATIONS 200000
+#define FUZZ_MAX_LENGTH 64
+#define BENCHMARK_TEXT_SIZE (64*1024)
+#define BENCHMARK_MIN_TIME 0.25
+
+unsigned int random_state = 12345;
+
+unsigned int random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+//Append a valid UTF-8 encoding of codepoint, returns the number of bytes
+int encode_utf8(unsigned char* out, unsigned int codepoint)
+{
+    if (codepoint < 0x80) { out[0] = codepoint; return 1; }
+    if (codepoint < 0x800) { out[0] = 0xc0 | (codepoint >> 6); out[1] = 0x80 | (codepoint & 0x3f); return 2; }
+    if (codepoint < 0x10000)
+    {
+        out[0] = 0xe0 | (codepoint >> 12); out[1] = 0x80 | ((codepoint >> 6) & 0x3f); out[2] = 0x80 | (codepoint & 0x3f);
+        return 3;
+    }
+    out[0] = 0xf0 | (codepoint >> 18); out[1] = 0x80 | ((codepoint >> 12) & 0x3f);
+    out[2] = 0x80 | ((codepoint >> 6) & 0x3f); out[3] = 0x80 | (codepoint & 0x3f);
+    return 4;
+}
+
+//Build a random string biased towards the edge cases of the decoder, the string is '\0' terminated
+int random_text(unsigned char* text, int max_length)
+{
+    static const unsigned char edge_bytes[] = { 0x7f, 0x80, 0xbf, 0xc0, 0xc1, 0xc2, 0xdf, 0xe0, 0xed, 0xef, 0xf0, 0xf4, 0xf5, 0xf8, 0xff, 0x3f, '\n' };
+    static const unsigned int edge_codepoints[] = { 0x7f, 0x80, 0x7ff, 0x800, 0xd7ff, 0xe000, 0xfffd, 0xffff, 0x10000, 0x10ffff };
+
+    int length = 0;
+
+    while (length < max_length - 4)
+    {
+        unsigned char sequence[4];
+        int size = 0;
+
+        switch (random_next() % 6)
+        {
+            case 0: sequence[0] = 0x20 + random_next() % 0x5f; size = 1; break;
+            case 1: size = encode_utf8(sequence, edge_codepoints[random_next() % (sizeof(edge_codepoints)/sizeof(edge_codepoints[0]))]); break;
+            case 2: size = encode_utf8(sequence, 0x80 + random_next() % 0x10ff80); break;
+            case 3: sequence[0] = edge_bytes[random_next() % sizeof(edge_bytes)]; size = 1; break;
+            case 4: sequence[0] = 1 + random_next() % 255; size = 1; break;
+            case 5: size = encode_utf8(sequence, 0x80 + random_next() % 0x10ff80) - 1; break; //Truncated sequence
+        }
+
+        if ((size > 1) && (random_next() % 8 == 0)) sequence[1 + random_next() % (size - 1)] = random_next() % 256; //Corrupted tail
+
+        for (int i = 0; i < size; i++) if (sequence[i] != '\0') text[length++] = sequence[i];
+
+        if (random_next() % 16 == 0) break;
+    }
+
+    text[length] = '\0';
+    return length;
+}
+
+//Decode like the text functions used to: bad bytes are skipped one by one
+int reference_decode(const char* text, int length, int* codepoints)
+{
+    int count = 0;
+
+    for (int i = 0; i < length; i++)
+    {
+        int next = 0;
+        int letter = _rf_get_next_utf8_codepoint(&text[i], &next);
+
+        if (letter == 0x3f) next = 1;
+        i += (next - 1);
+
+        codepoints[count++] = letter;
+    }
+
+    return count;
+}
+
+int reference_validate(const char* text, int length)
+{
+    for (int i = 0; i < length; i++)
+    {
+        int next = 0;
+        int letter = _rf_get_next_utf8_codepoint(&text[i], &next);
+
+        if ((letter == 0x3f) && (text[i] != '?')) return i;
+
+        i += (next - 1);
+    }
+
+    return -1;
+}
+
+int fuzz(int iterations)
+{
+    unsigned char text[FUZZ_MAX_LENGTH + 1];
+    int expected[FUZZ_MAX_LENGTH];
+    int decoded[FUZZ_MAX_LENGTH + 16];
+    int failures = 0;
+
+    for (int iteration = 0; iteration < iterations; iteration++)
+    {
+        int length = random_text(text, FUZZ_MAX_LENGTH);
+        int expected_count = reference_decode((const char*)text, length, expected);
+
+        //Decode in chunks of random size to also cover the chunk boundaries
+        int count = 0;
+        for (int i = 0; i < length;)
+        {
+            int bytes = 0;
+            int chunk = 1 + random_next() % 40;
+            count += rf_decode_utf8((const char*)&text[i], length - i, &decoded[count], chunk, &bytes);
+            i += bytes;
+        }
+
+        bool same = (count == expected_count) && (memcmp(decoded, expected, count*sizeof(int)) == 0);
+        bool valid_same = rf_validate_utf8((const char*)text, length) == reference_validate((const char*)text, length);
+
+        if (!same || !valid_same)
+        {
+            if (failures++ < 10)
+            {
+                printf("mismatch on iteration %i (%s):", iteration, same? "validate" : "decode");
+                for (int i = 0; i < length; i++) printf(" %02x", text[i]);
+                printf("\n");
+            }
+        }
+    }
+
+    return failures;
+}
+
+//Fill size bytes with whole UTF-8 sequences of codepoints picked from ranges
+void fill_text(char* text, int size, const unsigned int* ranges, int ranges_count)
+{
+    int length = 0;
+
+    while (1)
+    {
+        const unsigned int* range = &ranges[2*(random_next() % ranges_count)];
+        unsigned char sequence[4];
+        int sequence_size = encode_utf8(sequence, range[0] + random_next() % (range[1] - range[0] + 1));
+
+        if (length + sequence_size >= size) break;
+
+        memcpy(&text[length], sequence, sequence_size);
+        length += sequence_size;
+    }
+
+    memset(&text[length], ' ', size - 1 - length);
+    text[size - 1] = '\0';
+}
+
+void benchmark(const char* name, const char* text, int length, int* codepoints)
+{
+    double reference_speed = 0;
+    double decode_speed = 0;
+    int runs = 0;
+    int count = 0;
+
+    double start = rf_get_time();
+    for (runs = 0; (rf_get_time() - start) < BENCHMARK_MIN_TIME; runs++) count = reference_decode(text, length, codepoints);
+    reference_speed = (double)length*runs/(rf_get_time() - start)/(1024.0*1024.0);
+
+    start = rf_get_time();
+    for (runs = 0; (rf_get_time() - start) < BENCHMARK_MIN_TIME; runs++) count = rf_decode_utf8(text, length, codepoints, length, NULL);
+    decode_speed = (double)length*runs/(rf_get_time() - start)/(1024.0*1024.0);
+
+    printf("%-8s %7i codepoints  byte by byte: %8.1f MB/s  rf_decode_utf8: %8.1f MB/s  (%.1fx)\n",
+           name, count, reference_speed, decode_speed, decode_speed/reference_speed);
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = (argc > 1)? atoi(argv[1]) : DEFAULT_FUZZ_ITERATIONS;
+
+    int failures = fuzz(iterations);
+    printf("fuzz: %i iterations, %i mismatches\n", iterations, failures);
+
+    static const unsigned int ascii[] = { 0x20, 0x7e, '\n', '\n' };
+    static const unsigned int mixed[] = { 0x20, 0x7e, 0xc0, 0x17f, 0x400, 0x4ff };
+    static const unsigned int cjk[] = { 0x4e00, 0x9fff, 0x3040, 0x30ff, 0x20, 0x20 };
+
+    char* text = (char*) malloc(BENCHMARK_TEXT_SIZE);
+    int* codepoints = (int*) malloc(BENCHMARK_TEXT_SIZE*sizeof(int));
+
+    fill_text(text, BENCHMARK_TEXT_SIZE, ascii, 2);
+    benchmark("ascii", text, strlen(text), codepoints);
+
+    fill_text(text, BENCHMARK_TEXT_SIZE, mixed, 3);
+    benchmark("mixed", text, strlen(text), codepoints);
+
+    fill_text(text, BENCHMARK_TEXT_SIZE, cjk, 3);
+    benchmark("cjk", text, strlen(text), codepoints);
+
+    free(codepoints);
+    free(text);
+
+    return (failures == 0)? 0 : 1;
+}
@@ -0,0 +1,111 @@
+//Vertex emit benchmark: emits the same quads through the global context functions (rf_gl_vertex2f...) and through the
+//explicit context functions (rf_gl_vertex2f_ctx...), only the emitting is timed, batch flushes happen outside the timings
+//Every REPORT_INTERVAL frames the throughput of both paths is printed in millions of vertices per second
+
+#define RF_RENDERER_IMPL
+#define RF_GRAPHICS_API_OPENGL_33
+#include "glad/glad.h"
+#include "rayfork_renderer.h"
+#include "game.h"
+
+rf_context rf_ctx;
+
+#define QUADS_PER_CHUNK 4096 // Fits in the default batch, so no flush happens while timing
+#define CHUNKS_PER_FRAME 16
+#define REPORT_INTERVAL 120
+
+int    frames_count;
+double global_time;
+double ctx_time;
+double vertex_count;
+
+// Emit a chunk of quads through the global context
+void emit_global(int chunk)
+{
+    rf_gl_begin(GL_QUADS);
+    for (int i = 0; i < QUADS_PER_CHUNK; i++)
+    {
+        float x = (float)(i % 128) * 6.0f;
+        float y = (float)(chunk * 32 + i / 128) * 0.8f;
+
+        rf_gl_color4ub(i & 0xff, chunk * 16, 128, 255);
+        rf_gl_tex_coord2f(0.0f, 0.0f); rf_gl_vertex2f(x, y);
+        rf_gl_tex_coord2f(0.0f, 1.0f); rf_gl_vertex2f(x, y + 4.0f);
+        rf_gl_tex_coord2f(1.0f, 1.0f); rf_gl_vertex2f(x + 4.0f, y + 4.0f);
+        rf_gl_tex_coord2f(1.0f, 0.0f); rf_gl_vertex2f(x + 4.0f, y);
+    }
+    rf_gl_end();
+}
+
+// Emit the same chunk of quads through an explicit context
+void emit_ctx(rf_context* ctx, int chunk)
+{
+    rf_gl_begin_ctx(ctx, GL_QUADS);
+    for (int i = 0; i < QUADS_PER_CHUNK; i++)
+    {
+        float x = (float)(i % 128) * 6.0f;
+        float y = (float)(chunk * 32 + i / 128) * 0.8f;
+
+        rf_gl_color4ub_ctx(ctx, i & 0xff, chunk * 16, 128, 255);
+        rf_gl_tex_coord2f_ctx(ctx, 0.0f, 0.0f); rf_gl_vertex2f_ctx(ctx, x, y);
+        rf_gl_tex_coord2f_ctx(ctx, 0.0f, 1.0f); rf_gl_vertex2f_ctx(ctx, x, y + 4.0f);
+        rf_gl_tex_coord2f_ctx(ctx, 1.0f, 1.0f); rf_gl_vertex2f_ctx(ctx, x + 4.0f, y + 4.0f);
+        rf_gl_tex_coord2f_ctx(ctx, 1.0f, 0.0f); rf_gl_vertex2f_ctx(ctx, x + 4.0f, y);
+    }
+    rf_gl_end_ctx(ctx);
+}
+
+void on_init(void)
+{
+    //Load opengl with glad
+    gladLoadGL();
+
+    //Initialise rayfork and load the default font
+    rf_context_init(&rf_ctx, screen_width, screen_height);
+    rf_load_font_default();
+}
+
+void on_frame(const input_data input)
+{
+    // Draw
+    rf_begin_drawing();
+
+    rf_clear_background(rf_raywhite);
+
+    // Alternate which path goes first so neither one always gets the warm caches
+    for (int chunk = 0; chunk < CHUNKS_PER_FRAME; chunk++)
+    {
+        bool ctx_first = (chunk + frames_count) % 2;
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            rf_gl_draw(); // Start from an empty batch, outside the timing
+
+            double start = rf_get_time();
+            if (ctx_first == (pass == 0)) emit_ctx(&rf_ctx, chunk);
+            else emit_global(chunk);
+            double elapsed = rf_get_time() - start;
+
+            if (ctx_first == (pass == 0)) ctx_time += elapsed;
+            else global_time += elapsed;
+        }
+
+        vertex_count += QUADS_PER_CHUNK * 4;
+    }
+
+    rf_draw_rectangle(0, 0, screen_width, 40, rf_black);
+    rf_draw_fps(10, 10);
+
+    rf_end_drawing();
+
+    frames_count++;
+    if (frames_count % REPORT_INTERVAL == 0)
+    {
+        printf("global context: %.1f Mvertices/s, explicit context: %.1f Mvertices/s (%.2fx)\n",
+               vertex_count / global_time / 1e6, vertex_count / ctx_time / 1e6, global_time / ctx_time);
+
+        global_time = 0.0;
+        ctx_time = 0.0;
+        vertex_count = 0.0;
+    }
+}